@@ -0,0 +1,65 @@
+//  for help look at: https://github.com/Starmbi/hp_BH1750/wiki
+//
+//  This is an example of periodic measurements on a fixed time grid.
+//
+//  If you start the next measurement whenever hasValue() is true, the time between
+//  two samples depends on how long your loop needs.
+//  With startPeriodic() each measurement is started at an exact multiple of the period,
+//  and each sample gets a timestamp in the middle of its integration time.
+//  The statistics show how late (in microseconds) the measurements were started.
+
+#include <Arduino.h>
+#include <hp_BH1750.h> //  include the library
+hp_BH1750 sens;
+
+const unsigned int PERIOD = 100; //  period in milliseconds
+unsigned long lastPrint;
+
+void setup()
+{
+  //  put your setup code here, to run once:
+  Serial.begin(9600);
+  sens.begin(BH1750_TO_GROUND); //  change to (BH1750_TO_VCC) if address pin connected to VCC
+  sens.calibrateTiming();       //  the more exact the timing, the more exact the timestamps
+  sens.setQuality(BH1750_QUALITY_LOW);   //  conversion time ~16 ms at default mtreg, fits into 100 ms
+  sens.writeMtreg(BH1750_MTREG_DEFAULT);  //  with BH1750_QUALITY_HIGH it would be ~120 ms (180 ms uncalibrated)
+  //  sens.startPeriodic(PERIOD, syncMicros) aligns the grid to a micros() value shared with other instruments
+  if (!sens.startPeriodic(PERIOD))
+  {
+    Serial.println("Conversion time is longer than the period!");
+    while (true)
+    {
+      yield();
+    };
+  }
+  lastPrint = millis();
+}
+
+void loop()
+{
+  //  put your main code here, to run repeatedly:
+  if (sens.periodicHasValue())
+  {
+    float lux = sens.getLux();
+    Serial.print(sens.getSampleMicros());
+    Serial.print(char(9));
+    Serial.println(lux);
+  }
+  if (millis() - lastPrint >= 10000) //  print statistics every 10 seconds
+  {
+    lastPrint = millis();
+    BH1750Jitter j = sens.getJitter();
+    Serial.print("samples: ");
+    Serial.print(j.samples);
+    Serial.print(" missed: ");
+    Serial.print(j.missed);
+    Serial.print(" jitter min/mean/max [us]: ");
+    Serial.print(j.minMicros);
+    Serial.print("/");
+    Serial.print(j.samples > 0 ? j.sumMicros / j.samples : 0);
+    Serial.print("/");
+    Serial.println(j.maxMicros);
+    sens.resetJitter();
+  }
+  //  do a lot of other stuff here, but not longer than the period...
+}
@@ -0,0 +1,56 @@
+//  for help look at: https://github.com/Starmbi/hp_BH1750/wiki
+//
+//  This is an example how to send only values that have changed.
+//
+//  If every value is sent to a server or over radio, the transmission costs much more
+//  than the measurement. hasChanged() returns true only if the light changed more than
+//  the threshold, or if nothing was sent for a long time (heartbeat).
+//  Here a change must be more than 3 times the resolution of the current measurement,
+//  so it is adjusted automatically by adjustSettings().
+
+#include <Arduino.h>
+#include <hp_BH1750.h> //  include the library
+hp_BH1750 sens;
+
+unsigned long lastPrint;
+
+void setup()
+{
+  //  put your setup code here, to run once:
+  Serial.begin(9600);
+  sens.begin(BH1750_TO_GROUND); //  change to (BH1750_TO_VCC) if address pin connected to VCC
+  sens.calibrateTiming();
+  //  more than 3 digits, 1 more digit if the direction changes, at least every 60 seconds
+  sens.setReportFilter(BH1750_REPORT_RESOLUTION, 3, 1, 60000);
+  //  sens.setReportFilter(BH1750_REPORT_PERCENT, 5);  //  or report changes of 5 percent
+  //  sens.setReportFilter(BH1750_REPORT_LUX, 10);     //  or report changes of 10 lux
+  sens.start();
+  lastPrint = millis();
+}
+
+void loop()
+{
+  //  put your main code here, to run repeatedly:
+  if (sens.hasValue())
+  {
+    if (sens.hasChanged())
+    {
+      Serial.println(sens.getReportedLux()); //  send your value here
+    }
+    sens.adjustSettings(90);
+    sens.start();
+  }
+  if (millis() - lastPrint >= 10000) //  print statistics every 10 seconds
+  {
+    lastPrint = millis();
+    BH1750ReportStats s = sens.getReportStats();
+    Serial.print("samples: ");
+    Serial.print(s.samples);
+    Serial.print(" reported: ");
+    Serial.print(s.reported);
+    Serial.print(" (heartbeats: ");
+    Serial.print(s.heartbeats);
+    Serial.print(") suppressed: ");
+    Serial.println(s.suppressed);
+  }
+}
@@ -14,10 +14,14 @@ hp_BH1750 sens;
 void setup()
 {
   //  put your setup code here, to run once:
-  Wire.setClock(400000); //  uncomment this line if you have problems with communication
   Serial.begin(9600);
   //Serial.begin(115200);       // try this line for faster printing, uncomment the line above
   sens.begin(BH1750_TO_GROUND); //  change to (BH1750_TO_VCC) if address pin connected to VCC
+  unsigned long clock = sens.calibrateBus(); //  find the fastest reliable I2C clock (instead of Wire.setClock(400000))
+  Serial.print(clock);
+  Serial.print(" Hz, read: ");
+  Serial.print(sens.getReadMicros());
+  Serial.println(" us");
   sens.calibrateTiming();       //  you need a little brightness for this
 }
 
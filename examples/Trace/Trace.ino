@@ -0,0 +1,47 @@
+//  for help look at: https://github.com/Starmbi/hp_BH1750/wiki
+//
+//  This is an example how to record the communication with the sensor.
+//
+//  Every command and every read is stored with its time in a buffer.
+//  Here the compression is switched on: repeated reads while waiting for a result need only one entry
+//  together, but only the times of the first and the last of them are kept.
+//  Switch it off if you need the time of every single read (and have enough memory).
+//  Send a "d" over the serial monitor and the recorded transactions are dumped in binary form.
+//  Capture the serial output into a file, for example with
+//  "cat /dev/ttyUSB0 > trace.bin", and replay it on a PC with the program in extras/replay.
+//  The replay runs this sketch with the recorded values, so the recording must start with begin().
+//  That's why the buffer is not used as a ring: the recording stops if it is full.
+//  With compression 100 entries hold begin(), calibrateTiming() and about 10 measurements.
+
+#include <Arduino.h>
+#include <hp_BH1750.h> //  include the library
+hp_BH1750 sens;
+
+const unsigned int TRACE_SIZE = 100;  //  8 bytes each, adjust the value to your free memory on the board
+BH1750TraceEntry trace[TRACE_SIZE];
+
+void setup()
+{
+  //  put your setup code here, to run once:
+  Serial.begin(9600);
+  sens.setTrace(trace, TRACE_SIZE, false, true);  //  record from now on, stop if the buffer is full, compress repeated reads
+  sens.begin(BH1750_TO_GROUND);      //  change to (BH1750_TO_VCC) if address pin connected to VCC
+  sens.calibrateTiming();
+  sens.start();
+}
+
+void loop()
+{
+  //  put your main code here, to run repeatedly:
+  if (sens.hasValue())
+  {
+    float lux = sens.getLux();
+    Serial.println(lux);
+    sens.adjustSettings(90);
+    sens.start();
+  }
+  if (Serial.available() > 0 && Serial.read() == 'd')
+  {
+    sens.dumpTrace(Serial);
+  }
+}
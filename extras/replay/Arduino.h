@@ -0,0 +1,47 @@
+//  Minimal Arduino environment for replaying a bus trace on a PC
+//  Only what hp_BH1750 and the example sketches need
+
+#ifndef Arduino_h
+#define Arduino_h
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+class Print
+{
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t b);
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t print(const char *s);
+  size_t print(char c);
+  size_t print(long n);
+  size_t print(unsigned long n);
+  size_t print(int n) { return print((long)n); }
+  size_t print(unsigned int n) { return print((unsigned long)n); }
+  size_t print(double f, int digits = 2);
+  size_t println() { return print('\n'); }
+  template <typename T>
+  size_t println(T v) { return print(v) + println(); }
+  size_t println(double f, int digits) { return print(f, digits) + println(); }
+  size_t printf(const char *format, ...);
+};
+
+class HardwareSerial : public Print
+{
+public:
+  void begin(unsigned long) {}
+  int available() { return 0; }
+  int read() { return -1; }
+};
+
+extern HardwareSerial Serial;
+#endif
@@ -0,0 +1,29 @@
+//  Mock of the Wire library for replaying a bus trace on a PC
+//  Every transaction is checked against the next recorded entry and answered with its result
+
+#ifndef Wire_h
+#define Wire_h
+#include <Arduino.h>
+
+class TwoWire
+{
+public:
+  void begin() {}
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t b);
+  uint8_t endTransmission(bool stop = true);
+  uint8_t requestFrom(int address, int quantity);
+  int available();
+  int read();
+
+private:
+  uint8_t _address = 0;
+  uint8_t _data = 0;
+  uint8_t _buff[2];
+  int _len = 0;
+  int _pos = 0;
+};
+
+extern TwoWire Wire;
+#endif
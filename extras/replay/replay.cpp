@@ -0,0 +1,279 @@
+//  Replay a bus trace recorded with hp_BH1750::dumpTrace() on a PC
+//
+//  The sketch given to make (SKETCH=...) runs against a mock bus:
+//  each command must match the next recorded entry and each read returns the recorded value.
+//  The clock jumps to the recorded time of each transaction, between transactions every call
+//  of micros() or millis() advances it by one microsecond. So the same trace always gives
+//  the same sequence of decisions (calibrateTiming(), adjustSettings(), ...) and the same output.
+//  Compressed repeated reads are spread evenly between the first and the last repetition. If the
+//  library stops polling earlier than recorded, this is a divergence like any other.
+//
+//  The trace must start with begin() of the sketch, so record it with setTrace(buffer, size, false).
+//  A trace of a ring that wrapped around is rejected.
+//
+//  make SKETCH=../../examples/Trace/Trace.ino
+//  ./replay trace.bin
+//  make check      (replays testdata/Trace.bin and compares the output with testdata/Trace.txt)
+//
+//  Exit code 0: all entries replayed, 1: the library did something else than recorded, 2: bad file
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <vector>
+
+void setup();
+void loop();
+
+HardwareSerial Serial;
+TwoWire Wire;
+
+struct Entry
+{
+  uint64_t time; // Recorded micros(), without overflow
+  uint8_t address;
+  uint8_t flags;
+  uint16_t data;
+  bool repeated; // Expanded from a repeat entry
+};
+
+static const uint8_t TRACE_READ = 0x1;
+static const uint8_t TRACE_ACK = 0x2;
+static const uint8_t TRACE_REPEAT = 0x4;
+static const uint8_t TRACE_WRAPPED = 0x1;
+static const uint8_t TRACE_FULL = 0x2;
+static const uint64_t IDLE_LIMIT = 10000000; // Stop 10 s after the last entry without bus activity
+
+static std::vector<Entry> trace;
+static size_t next = 0;
+static uint64_t now = 0;
+
+//********************************************************************************************
+// Print a summary and end the replay
+
+static void finish(int code)
+{
+  fflush(stdout);
+  fprintf(stderr, "replayed %u of %u reads and writes, %.3f s\n", (unsigned)next, (unsigned)trace.size(),
+          trace.empty() ? 0.0 : (now - trace[0].time) / 1e6);
+  exit(code);
+}
+
+//********************************************************************************************
+// Return the next entry if it matches the transaction of the library, otherwise stop
+
+static const Entry &take(bool isRead, uint8_t address, uint8_t data)
+{
+  if (next >= trace.size())
+    finish(0);
+  const Entry &e = trace[next];
+  bool recordedRead = (e.flags & TRACE_READ) != 0;
+  if (recordedRead != isRead || e.address != address || (!isRead && e.data != data))
+  {
+    fflush(stdout);
+    fprintf(stderr, "divergence at transaction %u: recorded %s 0x%02X data 0x%04X, library %s 0x%02X data 0x%02X\n",
+            (unsigned)next, recordedRead ? (e.repeated ? "repeated read" : "read") : "write", e.address, e.data,
+            isRead ? "read" : "write", address, isRead ? 0 : data);
+    finish(1);
+  }
+  if (e.time > now)
+    now = e.time;
+  next++;
+  return e;
+}
+
+//********************************************************************************************
+// Time
+
+unsigned long micros()
+{
+  now++;
+  if (next >= trace.size() && !trace.empty() && now > trace.back().time + IDLE_LIMIT)
+    finish(0);
+  return (unsigned long)now; // Never overflows here, the library behaves the same with the overflow on the board
+}
+
+unsigned long millis()
+{
+  micros();
+  return (unsigned long)(now / 1000);
+}
+
+void delay(unsigned long ms)
+{
+  now += (uint64_t)ms * 1000;
+}
+
+void yield()
+{
+}
+
+//********************************************************************************************
+// Mock bus
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+  _address = address;
+}
+
+size_t TwoWire::write(uint8_t b)
+{
+  _data = b;
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool)
+{
+  const Entry &e = take(false, _address, _data);
+  return (e.flags & TRACE_ACK) ? 0 : 2;
+}
+
+uint8_t TwoWire::requestFrom(int address, int quantity)
+{
+  const Entry &e = take(true, (uint8_t)address, 0);
+  _pos = 0;
+  _len = 0;
+  if (!(e.flags & TRACE_ACK) || quantity < 2)
+    return 0;
+  _buff[0] = e.data >> 8;
+  _buff[1] = e.data & 0xFF;
+  _len = 2;
+  return 2;
+}
+
+int TwoWire::available()
+{
+  return _len - _pos;
+}
+
+int TwoWire::read()
+{
+  return (_pos < _len) ? _buff[_pos++] : -1;
+}
+
+//********************************************************************************************
+// Serial output goes to stdout
+
+size_t Print::write(uint8_t b)
+{
+  return fputc(b, stdout) == EOF ? 0 : 1;
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  return fwrite(buffer, 1, size, stdout);
+}
+
+size_t Print::print(const char *s)
+{
+  return write((const uint8_t *)s, strlen(s));
+}
+
+size_t Print::print(char c)
+{
+  return write((uint8_t)c);
+}
+
+size_t Print::print(long n)
+{
+  return printf("%ld", n);
+}
+
+size_t Print::print(unsigned long n)
+{
+  return printf("%lu", n);
+}
+
+size_t Print::print(double f, int digits)
+{
+  return printf("%.*f", digits, f);
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  int n = vfprintf(stdout, format, args);
+  va_end(args);
+  return n < 0 ? 0 : n;
+}
+
+//********************************************************************************************
+// Load the trace. The file may contain other serial output, the trace starts at "BHT1"
+// Repeat entries are expanded to single reads
+
+static bool load(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+    return false;
+  std::vector<uint8_t> buff;
+  int c;
+  while ((c = fgetc(f)) != EOF)
+    buff.push_back((uint8_t)c);
+  fclose(f);
+
+  size_t pos = 0;
+  while (pos + 9 <= buff.size() && memcmp(&buff[pos], "BHT1", 4) != 0)
+    pos++;
+  if (pos + 9 > buff.size())
+    return false;
+  uint32_t count = buff[pos + 4] | (buff[pos + 5] << 8) | (buff[pos + 6] << 16) | ((uint32_t)buff[pos + 7] << 24);
+  uint8_t state = buff[pos + 8];
+  pos += 9;
+  if (pos + (size_t)count * 8 > buff.size())
+    return false;
+  if (state & TRACE_WRAPPED)
+  {
+    fprintf(stderr, "trace does not start with begin(), record it with setTrace(buffer, size, false)\n");
+    return false;
+  }
+  if (state & TRACE_FULL)
+    fprintf(stderr, "trace buffer was full, replay ends with the last recorded transaction\n");
+
+  uint64_t time = 0;
+  uint32_t last = 0;
+  for (uint32_t i = 0; i < count; i++, pos += 8)
+  {
+    uint32_t t = buff[pos] | (buff[pos + 1] << 8) | (buff[pos + 2] << 16) | ((uint32_t)buff[pos + 3] << 24);
+    time = (i == 0) ? t : time + (uint32_t)(t - last); // Unsigned difference handles the overflow of micros()
+    last = t;
+    Entry e = {time, buff[pos + 4], buff[pos + 5], (uint16_t)(buff[pos + 6] | (buff[pos + 7] << 8)), false};
+    if (e.flags != TRACE_REPEAT)
+    {
+      trace.push_back(e);
+      continue;
+    }
+    if (trace.empty() || !(trace.back().flags & TRACE_READ))
+    {
+      fprintf(stderr, "repeat entry without a read before\n");
+      return false;
+    }
+    Entry r = trace.back(); // Last read before the repetitions
+    uint64_t first = r.time;
+    r.repeated = true;
+    for (uint16_t n = 1; n <= e.data; n++)
+    {
+      r.time = first + (time - first) * n / e.data;
+      trace.push_back(r);
+    }
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2 || !load(argv[1]))
+  {
+    fprintf(stderr, "usage: %s trace.bin\n", argv[0]);
+    return 2;
+  }
+  if (trace.empty())
+    finish(0);
+  now = trace[0].time;
+  setup();
+  while (true)
+    loop();
+}
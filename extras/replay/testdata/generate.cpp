@@ -0,0 +1,233 @@
+//  Generate the test data for "make check" with a simulated BH1750
+//
+//  The Trace example runs against a simple model of the sensor (conversion time proportional to mtreg,
+//  raw value from a light level that jumps from 500 lx to 40000 lx after 4 s) on a virtual clock.
+//  When the trace buffer is full, the trace is written with dumpTrace() and the serial output of the
+//  sketch up to the first transaction that was not recorded is written as the expected output.
+//
+//  make testdata     (writes testdata/Trace.bin and testdata/Trace.txt)
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <hp_BH1750.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string>
+
+void setup();
+void loop();
+extern hp_BH1750 sens; // From the sketch
+
+HardwareSerial Serial;
+TwoWire Wire;
+
+static const uint64_t START = 4294000000ULL;   // micros() of the board overflows after one second
+static const uint64_t LIGHT_JUMP = 4000000;    // Time of the light change
+static const uint64_t TIME_LIMIT = 60000000;   // Give up if the buffer is never full
+static const uint64_t WRITE_MICROS = 100;      // Bus time of a command
+static const uint64_t READ_MICROS = 200;       // Bus time of a 2-byte read
+
+static uint64_t now = START;
+static std::string output;  // Serial output since the last transaction
+static FILE *txt;
+static const char *binPath;
+
+// Simulated sensor
+static const uint8_t ADDRESS = BH1750_TO_GROUND;
+static int mtreg = BH1750_MTREG_DEFAULT;
+static int mode = 0;          // Running measurement, 0 if none
+static uint64_t ready = 0;    // End of the running measurement
+static uint16_t data = 0;     // Data register
+static uint16_t pending = 0;  // Result of the running measurement
+
+//********************************************************************************************
+// Write the test data and stop
+
+struct FilePrint : Print
+{
+  FILE *f;
+  size_t write(uint8_t b) { return fputc(b, f) == EOF ? 0 : 1; }
+  size_t write(const uint8_t *buffer, size_t size) { return fwrite(buffer, 1, size, f); }
+};
+
+static void finish()
+{
+  FilePrint bin;
+  bin.f = fopen(binPath, "wb");
+  if (bin.f == NULL)
+    exit(2);
+  sens.dumpTrace(bin);
+  fclose(bin.f);
+  fclose(txt);
+  fprintf(stderr, "%u entries, %.3f s\n", sens.getTraceCount(), (now - START) / 1e6);
+  exit(0);
+}
+
+//********************************************************************************************
+// Called before each transaction: the replay ends at the first transaction that is not in the trace,
+// so the output after it is dropped
+
+static void transaction()
+{
+  if ((sens.getTraceState() & BH1750_TRACE_FULL) || now - START > TIME_LIMIT)
+    finish();
+  fwrite(output.data(), 1, output.size(), txt);
+  output.clear();
+}
+
+//********************************************************************************************
+// Time
+
+unsigned long micros()
+{
+  now++;
+  return (unsigned long)now;
+}
+
+unsigned long millis()
+{
+  micros();
+  return (unsigned long)(now / 1000);
+}
+
+void delay(unsigned long ms)
+{
+  now += (uint64_t)ms * 1000;
+}
+
+void yield()
+{
+}
+
+//********************************************************************************************
+// Simulated bus
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+  transaction();
+  _address = address;
+}
+
+size_t TwoWire::write(uint8_t b)
+{
+  _data = b;
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool)
+{
+  now += WRITE_MICROS;
+  if (_address != ADDRESS)
+    return 2;
+  if ((_data & 0xF8) == 0x40)
+    mtreg = (mtreg & 0x1F) | ((_data & 0x7) << 5);
+  else if ((_data & 0xE0) == 0x60)
+    mtreg = (mtreg & 0xE0) | (_data & 0x1F);
+  else if (_data == 0x7)
+    data = 0;
+  else if (_data == BH1750_QUALITY_HIGH || _data == BH1750_QUALITY_HIGH2 || _data == BH1750_QUALITY_LOW)
+  {
+    mode = _data;
+    double ms = ((mode == BH1750_QUALITY_LOW) ? 16.0 : 120.0) * mtreg / BH1750_MTREG_DEFAULT;
+    ready = now + (uint64_t)(ms * 1000);
+    double lux = (now - START < LIGHT_JUMP) ? 500 : 40000;
+    double raw = lux * 1.2 * mtreg / BH1750_MTREG_DEFAULT / ((mode == BH1750_QUALITY_HIGH2) ? 0.5 : 1.0);
+    if (mode == BH1750_QUALITY_LOW)
+      raw = (long)raw & ~3L; // Low quality has steps of 4 digits
+    pending = (raw > BH1750_SATURATED) ? BH1750_SATURATED : (uint16_t)raw;
+  }
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(int address, int)
+{
+  transaction();
+  now += READ_MICROS;
+  _pos = 0;
+  _len = 0;
+  if (address != ADDRESS)
+    return 0;
+  if (mode != 0 && now >= ready)
+  {
+    data = pending;
+    mode = 0;
+  }
+  _buff[0] = data >> 8;
+  _buff[1] = data & 0xFF;
+  _len = 2;
+  return 2;
+}
+
+int TwoWire::available()
+{
+  return _len - _pos;
+}
+
+int TwoWire::read()
+{
+  return (_pos < _len) ? _buff[_pos++] : -1;
+}
+
+//********************************************************************************************
+// Serial output is collected until the next transaction
+
+size_t Print::write(uint8_t b)
+{
+  output += (char)b;
+  return 1;
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  output.append((const char *)buffer, size);
+  return size;
+}
+
+size_t Print::print(const char *s)
+{
+  return write((const uint8_t *)s, strlen(s));
+}
+
+size_t Print::print(char c)
+{
+  return write((uint8_t)c);
+}
+
+size_t Print::print(long n)
+{
+  return printf("%ld", n);
+}
+
+size_t Print::print(unsigned long n)
+{
+  return printf("%lu", n);
+}
+
+size_t Print::print(double f, int digits)
+{
+  return printf("%.*f", digits, f);
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char buff[128];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buff, sizeof(buff), format, args);
+  va_end(args);
+  return (n < 0) ? 0 : write((const uint8_t *)buff, strlen(buff));
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 3 || (txt = fopen(argv[2], "wb")) == NULL)
+  {
+    fprintf(stderr, "usage: %s trace.bin output.txt\n", argv[0]);
+    return 2;
+  }
+  binPath = argv[1];
+  setup();
+  while (true)
+    loop();
+}
@@ -23,6 +23,8 @@ bool hp_BH1750::begin(byte address, TwoWire *myWire)
 {
   _wire = myWire;
   _wire->begin();                  // Initialisation of wire object with standard SDA/SCL lines
+  if (_clock > 0)
+    _wire->setClock(_clock);       // Some cores reset the clock in begin(), so restore the value from calibrateBus()
   _address = address;              // Store one of the two available addresses
   _mtreg = BH1750_MTREG_DEFAULT;   // Default sensitivity
   _quality = BH1750_QUALITY_HIGH2; // Sets quality to most sensitive mode (recommend, exept it is really bright)
@@ -81,7 +83,9 @@ bool hp_BH1750::writeByte(byte b)
 {
   _wire->beginTransmission(_address);
   _wire->write(b);
-  return (_wire->endTransmission() == 0);
+  bool ack = (_wire->endTransmission() == 0);
+  traceRecord(_address, ack ? BH1750_TRACE_ACK : 0, b);
+  return ack;
 }
 
 //********************************************************************************************
@@ -108,12 +112,23 @@ bool hp_BH1750::start()
   reset(); // Reset the last result in data register to zero (0)
   bool result = writeByte(_quality);
   luxCache = (69.0 / _mtreg) * _qualFak;
+  _rawStep = (_quality == BH1750_QUALITY_LOW) ? 4 : 1;    // Smallest step of raw data, for getResolution()
   _startMillis = millis();                                // Stores the start time
-  _resultMillis = _startMillis + _mtregTime + _offset;    // Add the pre-calculated conversion time to start time,
-  _timeoutMillis = _startMillis + _mtregTime + _timeout;  // to predict the time when conversion should be finished
+  _startMicros = micros();                                // .. and with higher resolution for the sample timestamp
+  // The sensor starts with the command byte, inside the write. So the integration started about half a write ago
+  // The calibrated conversion time contains one read (see below), that is not part of the integration
+  _sampleMicros = _startMicros - _writeMicros / 2 + ((unsigned long)_mtregTime * 1000 - _readMicros) / 2; // Middle of the integration time, see getSampleMicros()
+  // Add the pre-calculated conversion time to start time, to predict the time when conversion should be finished
+  // calibrateTiming() measures until the END of the first successful read, so the calibrated times contain one read.
+  // The sensor answers with the value it has at the BEGINNING of the read, so we may ask one read time earlier
+  // without reading a zero. (The datasheet timings without calibration are much longer anyway.)
+  // The last read before the timeout can start before the conversion finished, so the timeout is one read later
+  _resultMicros = _startMicros + ((long)_mtregTime + _offset) * 1000 - _readMicros;
+  _timeoutMillis = _startMillis + _mtregTime + _timeout + _busMillis;
   _nReads = 0;        // Reset count for true readings to the sensor
   _value = 0;         // Reset last result
   _time = 0;          // Reset last measured conversion time
+  _readError = false; // No failed read yet
   _processed = false; // Value not readed by user
   return result;
 }
@@ -237,11 +252,13 @@ unsigned int hp_BH1750::readChange(byte mtreg, BH1750Quality quality, bool chang
   setQuality(quality);
   writeByte(quality);
   _startMillis = millis();
-  _resultMillis = _startMillis + _mtregTime + _offset;
-  _timeoutMillis = _startMillis + _mtregTime + _timeout;
+  _startMicros = micros();
+  _resultMicros = _startMicros + ((long)_mtregTime + _offset) * 1000 - _readMicros;
+  _timeoutMillis = _startMillis + _mtregTime + _timeout + _busMillis;
   _nReads = 0;
   _value = 0;
   _time = 0;
+  _readError = false;
   do
   {
     val = readValue();
@@ -320,10 +337,9 @@ void hp_BH1750::setQuality(BH1750Quality quality)
 // If forceSensor is true, then every time this function is called, the sensor is asked
 bool hp_BH1750::hasValue(bool forceSensor)
 {
-  unsigned long mil = millis();
   if (!forceSensor)
   {
-    if (_resultMillis > mil) // We are below the estimated time, so we return quickly
+    if ((long)(micros() - _resultMicros) < 0) // We are below the estimated time, so we return quickly
     {
       return false;
     }
@@ -423,6 +439,8 @@ unsigned int hp_BH1750::readValue()
   unsigned int req = _wire->requestFrom((int)_address, (int)2); // request two bytes
   if (req < 2 || _wire->available() < 2)
   {
+    traceRecord(_address, BH1750_TRACE_READ, 0);
+    _readError = true;
     _time = 999;
     _value = 0;
     return _value; // Sensor not found or other problem
@@ -432,6 +450,7 @@ unsigned int hp_BH1750::readValue()
   buff[1] = _wire->read(); // Receive one byte
   _nReads++; // Inc the physically count of reads
   _value = ((buff[0] << 8) | buff[1]);
+  traceRecord(_address, BH1750_TRACE_READ | BH1750_TRACE_ACK, _value);
 
   unsigned long mil = millis();
   if (_value > 0 && _time == 0)
@@ -607,3 +626,553 @@ void hp_BH1750::calcSettings(unsigned int value, BH1750Quality &qual, byte &mtre
 float hp_BH1750::getPercent() const {
   return _percent;
 }
+
+//********************************************************************************************
+// Periodic acquisition on an absolute time grid
+// Each measurement is started at a multiple of "period" (milliseconds) after this call.
+// The next grid point is always calculated from the last grid point and never from the time
+// the measurement really started, so a late start does not accumulate to a drift.
+// Returns false if the conversion time of the current quality and mtreg does not fit into the period
+// (see periodFits()).
+
+bool hp_BH1750::startPeriodic(unsigned int period)
+{
+  return startPeriodic(period, micros()); // First grid point is now
+}
+
+//********************************************************************************************
+// Overloaded
+// The grid is aligned to "firstMicros" (a micros() value), for example a sync time shared with other instruments.
+// If this time is already over, the grid starts with the next grid point in the future.
+
+bool hp_BH1750::startPeriodic(unsigned int period, unsigned long firstMicros)
+{
+  if (period == 0 || !periodFits(_mtreg, period))
+  {
+    _period = 0;
+    return false;
+  }
+  unsigned long periodMicros = (unsigned long)period * 1000;
+  unsigned long mic = micros();
+  if ((long)(mic - firstMicros) > 0)
+    firstMicros += ((mic - firstMicros + periodMicros - 1) / periodMicros) * periodMicros;
+  _period = period;
+  _pending = false;
+  _nextMicros = firstMicros;
+  resetJitter();
+  return true;
+}
+
+//********************************************************************************************
+// Private function. Check if a measurement with this mtreg (and the current quality) fits into the period
+// Offset, timeout (a dark result is only known after the timeout), the bus time (see calibrateBus())
+// and 1 ms for the resolution of millis() are added to the conversion time.
+
+bool hp_BH1750::periodFits(byte mtreg, unsigned int period) const
+{
+  unsigned long need = getMtregTime(mtreg) + 1;
+  need += ((long)_timeout > _offset) ? _timeout : _offset;
+  need += (3UL * _writeMicros + _readMicros + 999) / 1000; // start() sends 3 commands, then one read
+  return need < period;
+}
+
+//********************************************************************************************
+// Leave the periodic acquisition. A running measurement can still be read with hasValue()/getLux()
+
+void hp_BH1750::stopPeriodic()
+{
+  _period = 0;
+  _pending = false;
+}
+
+//********************************************************************************************
+// Call this function as often as possible in the main loop, instead of hasValue() and start()
+// When a grid point is reached, the next measurement is started
+// If the settings were changed and the conversion time is longer than the period now, mtreg is lowered
+// until it fits. If this is not possible (quality too slow) the periodic acquisition stops, getPeriod() returns 0
+// Returns true exactly once for each finished measurement, then read it with getLux() or getRaw()
+// and its timestamp with getSampleMicros()
+
+bool hp_BH1750::periodicHasValue()
+{
+  if (_period == 0)
+    return false;
+  unsigned long mic = micros();
+  unsigned long periodMicros = (unsigned long)_period * 1000;
+  bool due = ((long)(mic - _nextMicros) >= 0); // Grid point reached
+  if (_pending && hasValue(due)) // Collect the result first, at the grid point ask the sensor in any case
+  {
+    _pending = false;
+    return true; // Next measurement is started with the next call
+  }
+  if (due)
+  {
+    unsigned long late = mic - _nextMicros;
+    if (late >= periodMicros) // We missed one or more grid points, so we skip them
+    {
+      unsigned long skip = late / periodMicros;
+      _jitter.missed += skip;
+      _nextMicros += skip * periodMicros;
+      late -= skip * periodMicros;
+    }
+    if (_pending)
+      _jitter.missed++; // Last measurement not finished, it will be lost
+    if (!periodFits(_mtreg, _period)) // Settings were changed, for example by adjustSettings()
+    {
+      byte mtreg = _mtreg;
+      while (mtreg > BH1750_MTREG_LOW && !periodFits(mtreg, _period))
+        mtreg--;
+      if (!periodFits(mtreg, _period))
+      {
+        stopPeriodic(); // Even the lowest mtreg is too slow for this quality
+        return false;
+      }
+      writeMtreg(mtreg); // Lower sensitivity, but the measurement fits into the period
+    }
+    start();
+    _nextMicros += periodMicros;
+    _pending = true;
+
+    _jitter.samples++;
+    _jitter.sumMicros += late;
+    if (late < _jitter.minMicros)
+      _jitter.minMicros = late;
+    if (late > _jitter.maxMicros)
+      _jitter.maxMicros = late;
+  }
+  return false;
+}
+
+//********************************************************************************************
+// Return the period of the periodic acquisition in milliseconds, 0 if not active
+
+unsigned int hp_BH1750::getPeriod() const
+{
+  return _period;
+}
+
+//********************************************************************************************
+// Return the estimated midpoint (micros()) of the integration window of the last measurement
+// Calculated in start() from the start time and the (calibrated) conversion time of that measurement
+
+unsigned long hp_BH1750::getSampleMicros() const
+{
+  return _sampleMicros;
+}
+
+//********************************************************************************************
+// Return the statistics of the delay between grid point and start of the measurement
+
+BH1750Jitter hp_BH1750::getJitter() const
+{
+  return _jitter;
+}
+
+void hp_BH1750::resetJitter()
+{
+  _jitter.samples = 0;
+  _jitter.missed = 0;
+  _jitter.minMicros = 0xFFFFFFFF;
+  _jitter.maxMicros = 0;
+  _jitter.sumMicros = 0;
+}
+
+// Clock rates tested by calibrateBus(), in ascending order
+static const unsigned long BH1750_CLOCKS[] = {100000, 200000, 300000, 400000, 600000, 800000, 1000000};
+
+//********************************************************************************************
+// Find the fastest reliable clock of the I2C bus and measure the time of one transaction
+// The clock is raised step by step up to "maxClock" (the datasheet allows 400 kHz).
+// At each step every BH1750 on this bus (both addresses) gets "repeats" command writes and 2-byte reads,
+// and every read must return the same value as at 100 kHz.
+// The fastest clock without errors is set and returned, 0 if this sensor did not answer or even 100 kHz failed.
+// Note: the sensors are searched at 100 kHz. If the function fails, the clock of an earlier successful
+// calibration is restored, otherwise the bus stays at 100 kHz (a clock set with Wire.setClock() is lost).
+// The measured times of a write and a read are used for the timing prediction of start().
+// Call this function in setup after begin() and before the first measurement.
+
+unsigned long hp_BH1750::calibrateBus(unsigned long maxClock, byte repeats)
+{
+  const byte addresses[2] = {BH1750_TO_GROUND, BH1750_TO_VCC};
+  unsigned int reference[2];
+  bool found[2];
+  unsigned long writeMicros = 0;
+  unsigned long readMicros = 0;
+  unsigned long bestClock = 0;
+  if (repeats == 0)
+    repeats = 1;
+
+  // At the slowest clock we look for sensors and read the current content of the data register
+  _wire->setClock(BH1750_CLOCKS[0]);
+  for (byte a = 0; a < 2; a++)
+  {
+    found[a] = false;
+    _wire->beginTransmission(addresses[a]);
+    _wire->write(0x1); // Power on, does not change the data register
+    byte err = _wire->endTransmission();
+    traceRecord(addresses[a], err == 0 ? BH1750_TRACE_ACK : 0, 0x1);
+    if (err != 0)
+      continue;
+    if (_wire->requestFrom((int)addresses[a], (int)2) < 2 || _wire->available() < 2)
+    {
+      traceRecord(addresses[a], BH1750_TRACE_READ, 0);
+      continue;
+    }
+    reference[a] = _wire->read() << 8;
+    reference[a] |= _wire->read();
+    traceRecord(addresses[a], BH1750_TRACE_READ | BH1750_TRACE_ACK, reference[a]);
+    found[a] = true;
+  }
+
+  bool own = (found[0] && addresses[0] == _address) || (found[1] && addresses[1] == _address);
+  for (byte c = 0; own && c < sizeof(BH1750_CLOCKS) / sizeof(BH1750_CLOCKS[0]); c++)
+  {
+    if (BH1750_CLOCKS[c] > maxClock)
+      break;
+    _wire->setClock(BH1750_CLOCKS[c]);
+    bool ok = true;
+    unsigned long w = 0;
+    unsigned long r = 0;
+    for (byte a = 0; a < 2 && ok; a++)
+    {
+      if (!found[a])
+        continue;
+      unsigned long tw, tr;
+      ok = testBus(addresses[a], reference[a], repeats, tw, tr);
+      if (addresses[a] == _address)
+      {
+        w = tw;
+        r = tr;
+      }
+    }
+    if (!ok)
+      break; // Higher clocks will not work better
+    bestClock = BH1750_CLOCKS[c];
+    writeMicros = w;
+    readMicros = r;
+  }
+
+  if (bestClock == 0) // Our sensor did not answer, keep the last settings (or 100 kHz, see above)
+  {
+    _wire->setClock(_clock > 0 ? _clock : BH1750_CLOCKS[0]);
+    return 0;
+  }
+  _wire->setClock(bestClock);
+  _clock = bestClock;
+  setBusCost(writeMicros, readMicros);
+  return bestClock;
+}
+
+//********************************************************************************************
+// Private function for calibrateBus()
+// Sends "repeats" commands and reads, checks each result and returns the mean time of a write and of a read
+
+bool hp_BH1750::testBus(byte address, unsigned int reference, byte repeats, unsigned long &writeMicros, unsigned long &readMicros)
+{
+  unsigned long sumWrite = 0;
+  unsigned long sumRead = 0;
+  for (byte i = 0; i < repeats; i++)
+  {
+    unsigned long mic = micros();
+    _wire->beginTransmission(address);
+    _wire->write(0x1);
+    byte err = _wire->endTransmission();
+    sumWrite += micros() - mic;
+    traceRecord(address, err == 0 ? BH1750_TRACE_ACK : 0, 0x1);
+    if (err != 0)
+      return false;
+
+    mic = micros();
+    byte req = _wire->requestFrom((int)address, (int)2);
+    if (req < 2 || _wire->available() < 2)
+    {
+      traceRecord(address, BH1750_TRACE_READ, 0);
+      return false;
+    }
+    unsigned int val = _wire->read() << 8;
+    val |= _wire->read();
+    sumRead += micros() - mic;
+    traceRecord(address, BH1750_TRACE_READ | BH1750_TRACE_ACK, val);
+    if (val != reference)
+      return false;
+  }
+  writeMicros = sumWrite / repeats;
+  readMicros = sumRead / repeats;
+  return true;
+}
+
+//********************************************************************************************
+// Return the clock found by calibrateBus(), 0 if not calibrated
+
+unsigned long hp_BH1750::getClock() const
+{
+  return _clock;
+}
+
+//********************************************************************************************
+// Return the measured time of a command write in microseconds
+
+unsigned int hp_BH1750::getWriteMicros() const
+{
+  return _writeMicros;
+}
+
+//********************************************************************************************
+// Return the measured time of a 2-byte read in microseconds
+
+unsigned int hp_BH1750::getReadMicros() const
+{
+  return _readMicros;
+}
+
+//********************************************************************************************
+// Set the time of a transaction (for example stored in eprom before)
+// Both are used for the timing prediction of the next start()
+
+void hp_BH1750::setBusCost(unsigned int writeMicros, unsigned int readMicros)
+{
+  _writeMicros = writeMicros;
+  _readMicros = readMicros;
+  _busMillis = (readMicros + 999) / 1000; // Rounded up, for the timeout
+}
+
+//********************************************************************************************
+// Record every bus transaction of this sensor into "buffer" of "size" entries
+// With wrap = true the buffer is a ring and the oldest entries are overwritten,
+// with wrap = false the recording stops if the buffer is full.
+// For a replay on a PC (extras/replay) the trace must start with begin(), so use wrap = false.
+// With compress = true repeated identical reads (polling for a result) are stored as one entry with a count.
+// This needs much less memory (calibrateTiming() polls some thousand times), but it is lossy:
+// only the times of the first and the last repetition are kept.
+// Set buffer to NULL to stop recording
+
+void hp_BH1750::setTrace(BH1750TraceEntry *buffer, unsigned int size, bool wrap, bool compress)
+{
+  _trace = (size > 0) ? buffer : NULL;
+  _traceSize = size;
+  _traceWrap = wrap;
+  _traceCompress = compress;
+  clearTrace();
+}
+
+//********************************************************************************************
+// Remove all recorded entries
+
+void hp_BH1750::clearTrace()
+{
+  _traceHead = 0;
+  _traceCount = 0;
+  _traceState = 0;
+}
+
+//********************************************************************************************
+// Return the number of entries in the buffer
+
+unsigned int hp_BH1750::getTraceCount() const
+{
+  return _traceCount;
+}
+
+//********************************************************************************************
+// Return BH1750_TRACE_WRAPPED if entries were overwritten, BH1750_TRACE_FULL if entries were dropped
+
+byte hp_BH1750::getTraceState() const
+{
+  return _traceState;
+}
+
+//********************************************************************************************
+// Send the recorded entries, oldest first, in binary form (for example to Serial)
+// Header: "BHT1", the number of entries (4 bytes) and the state (1 byte, see getTraceState())
+// Each entry: timestamp (4 bytes), address, flags, data (2 bytes), all numbers little endian
+// Use extras/replay to read it on a PC
+
+void hp_BH1750::dumpTrace(Print &out) const
+{
+  unsigned long count = _traceCount;
+  byte buff[9] = {'B', 'H', 'T', '1', (byte)(count & 0xFF), (byte)((count >> 8) & 0xFF),
+                  (byte)((count >> 16) & 0xFF), (byte)((count >> 24) & 0xFF), _traceState};
+  out.write(buff, 9);
+  unsigned int index = (_traceHead + _traceSize - _traceCount) % (_traceSize > 0 ? _traceSize : 1);
+  for (unsigned int i = 0; i < _traceCount; i++)
+  {
+    const BH1750TraceEntry &e = _trace[index];
+    buff[0] = e.timestamp & 0xFF;
+    buff[1] = (e.timestamp >> 8) & 0xFF;
+    buff[2] = (e.timestamp >> 16) & 0xFF;
+    buff[3] = (e.timestamp >> 24) & 0xFF;
+    buff[4] = e.address;
+    buff[5] = e.flags;
+    buff[6] = e.data & 0xFF;
+    buff[7] = (e.data >> 8) & 0xFF;
+    out.write(buff, 8);
+    if (++index >= _traceSize)
+      index = 0;
+  }
+}
+
+//********************************************************************************************
+// Private function. Store one transaction in the buffer
+// If compression is on, a read with the same result as the entry before is counted in a BH1750_TRACE_REPEAT entry
+// (data = number of repetitions, timestamp = last repetition)
+
+void hp_BH1750::traceRecord(byte address, byte flags, unsigned int data)
+{
+  if (_trace == NULL || (_traceState & BH1750_TRACE_FULL))
+    return;
+  unsigned long mic = micros();
+  if (_traceCompress && (flags & BH1750_TRACE_READ) && _traceCount > 0)
+  {
+    unsigned int last = (_traceHead > 0 ? _traceHead : _traceSize) - 1;
+    BH1750TraceEntry *base = &_trace[last];
+    BH1750TraceEntry *repeat = NULL;
+    if (base->flags == BH1750_TRACE_REPEAT && _traceCount > 1)
+    {
+      repeat = base;
+      base = &_trace[(last > 0 ? last : _traceSize) - 1];
+    }
+    if (base->address == address && base->flags == flags && base->data == data)
+    {
+      if (repeat != NULL && repeat->data < 0xFFFF)
+      {
+        repeat->data++;
+        repeat->timestamp = mic;
+        return;
+      }
+      if (repeat == NULL)
+      {
+        flags = BH1750_TRACE_REPEAT; // Start counting the repetitions
+        data = 1;
+      }
+    }
+  }
+  if (_traceCount >= _traceSize)
+  {
+    if (!_traceWrap)
+    {
+      _traceState |= BH1750_TRACE_FULL;
+      return;
+    }
+    _traceState |= BH1750_TRACE_WRAPPED;
+  }
+  BH1750TraceEntry &e = _trace[_traceHead];
+  e.timestamp = mic;
+  e.address = address;
+  e.flags = flags;
+  e.data = data;
+  if (++_traceHead >= _traceSize)
+    _traceHead = 0;
+  if (_traceCount < _traceSize)
+    _traceCount++;
+}
+
+//********************************************************************************************
+// Report only values that changed enough, to save the transmission of redundant values
+// A value is reported if it differs from the last reported value by more than the threshold.
+// The threshold is in lux, in percent of the last reported value or in multiples of the resolution
+// (see getResolution()). With BH1750_REPORT_RESOLUTION the threshold follows autoranging automatically.
+// With BH1750_REPORT_LUX and BH1750_REPORT_PERCENT the threshold is at least one resolution step,
+// so after autoranging to a lower sensitivity a flicker of one digit is not reported.
+// A change in the opposite direction of the last reported change needs threshold + hysteresis
+// (same unit as threshold), so a value toggling between two steps is not reported every time.
+// With maxSilence > 0 a value is reported at least every maxSilence milliseconds.
+// With BH1750_REPORT_RESOLUTION and a threshold of 0 every change is reported.
+
+void hp_BH1750::setReportFilter(BH1750ReportMode mode, float threshold, float hysteresis, unsigned long maxSilence)
+{
+  _reportMode = mode;
+  _reportThreshold = threshold;
+  _reportHysteresis = hysteresis;
+  _maxSilence = maxSilence;
+  _reportValid = false; // Next value is always reported
+  _reportDirection = 0;
+}
+
+//********************************************************************************************
+// Call this function after hasValue() returned true
+// Returns true, if the value should be sent. Then read it with getLux() or getReportedLux()
+// Failed reads are never reported and not counted.
+// Saturated values are counted, but never reported as a change (the true light is unknown).
+// They are reported as heartbeat after maxSilence, check saturated() before you send them.
+
+bool hp_BH1750::hasChanged()
+{
+  if (_readError)
+    return false;
+  float lux = getLux();
+  unsigned long mil = millis();
+  _reportStats.samples++;
+  if (_reportValid)
+  {
+    float diff = lux - _reportedLux;
+    signed char direction = (diff > 0) ? 1 : ((diff < 0) ? -1 : 0);
+    float resolution = getResolution();
+    float threshold = _reportThreshold;
+    if (direction != 0 && direction == -_reportDirection)
+      threshold += _reportHysteresis;
+    switch (_reportMode)
+    {
+      case BH1750_REPORT_RESOLUTION:
+        threshold *= resolution;
+        break;
+      case BH1750_REPORT_PERCENT:
+        threshold = threshold / 100.0 * fabs(_reportedLux); // No break, same lower limit as lux
+      case BH1750_REPORT_LUX:
+      default:
+        if (threshold < resolution)
+          threshold = resolution; // Smaller changes are only quantization
+    }
+    threshold += resolution / 100; // Rounding errors of float, a change is always a multiple of the resolution
+    if (saturated() || fabs(diff) <= threshold)
+    {
+      if (_maxSilence == 0 || mil - _reportMillis < _maxSilence)
+      {
+        _reportStats.suppressed++;
+        return false;
+      }
+      _reportStats.heartbeats++; // Nothing changed, but it is time for a sign of life
+    }
+    else
+    {
+      _reportDirection = direction;
+    }
+  }
+  _reportValid = true;
+  _reportedLux = lux;
+  _reportMillis = mil;
+  _reportStats.reported++;
+  return true;
+}
+
+//********************************************************************************************
+// Return the smallest change in lux the last measurement can show
+// This is one digit, or four digits at BH1750_QUALITY_LOW (quality and mtreg stored in start())
+
+float hp_BH1750::getResolution() const
+{
+  return luxCache / luxFactor * _rawStep;
+}
+
+//********************************************************************************************
+// Return the last value reported by hasChanged()
+
+float hp_BH1750::getReportedLux() const
+{
+  return _reportedLux;
+}
+
+//********************************************************************************************
+// Return the counts of reported and suppressed values
+
+BH1750ReportStats hp_BH1750::getReportStats() const
+{
+  return _reportStats;
+}
+
+void hp_BH1750::resetReportStats()
+{
+  _reportStats.samples = 0;
+  _reportStats.reported = 0;
+  _reportStats.suppressed = 0;
+  _reportStats.heartbeats = 0;
+}
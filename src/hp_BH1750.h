@@ -36,6 +36,45 @@ struct BH1750Timing
   unsigned int mtregLow_qualityLow;
   unsigned int mtregHigh_qualityLow;
 };
+struct BH1750Jitter
+{
+  unsigned long samples;       // Measurements started on the grid
+  unsigned long missed;        // Grid points skipped or samples overwritten before they were read
+  unsigned long minMicros;     // Smallest delay between grid point and start()
+  unsigned long maxMicros;     // Largest delay between grid point and start()
+  unsigned long sumMicros;     // Sum of all delays, for the mean divide by samples
+};
+struct BH1750TraceEntry
+{
+  uint32_t timestamp; // micros() at the end of the transaction
+  byte address;
+  byte flags;         // BH1750_TRACE_READ, BH1750_TRACE_ACK or BH1750_TRACE_REPEAT
+  uint16_t data;      // Command byte or read result
+};
+enum BH1750TraceFlag
+{
+  BH1750_TRACE_READ = 0x1,  // Not set for a command write
+  BH1750_TRACE_ACK = 0x2,   // Sensor acknowledged
+  BH1750_TRACE_REPEAT = 0x4 // The read before was repeated "data" times
+};
+enum BH1750TraceState
+{
+  BH1750_TRACE_WRAPPED = 0x1, // Oldest entries were overwritten
+  BH1750_TRACE_FULL = 0x2     // Buffer was full, newest entries were dropped
+};
+enum BH1750ReportMode
+{
+  BH1750_REPORT_LUX = 0,        // Threshold in lux
+  BH1750_REPORT_PERCENT = 1,    // Threshold in percent of the last reported value
+  BH1750_REPORT_RESOLUTION = 2, // Threshold in multiples of the resolution of the current measurement
+};
+struct BH1750ReportStats
+{
+  unsigned long samples;    // Values checked with hasChanged()
+  unsigned long reported;   // Values to send, including heartbeats
+  unsigned long suppressed; // Values not to send
+  unsigned long heartbeats; // Values reported only because of maxSilence
+};
 
 enum BH1750MtregLimit
 {
@@ -99,6 +138,34 @@ public:
   bool adjustSettings(float percent = 50.0, bool forcePreShot = false);
   void calcSettings(unsigned int value, BH1750Quality &qual, byte &mtreg, float percent);
 
+  bool startPeriodic(unsigned int period);
+  bool startPeriodic(unsigned int period, unsigned long firstMicros);
+  void stopPeriodic();
+  bool periodicHasValue();
+  unsigned int getPeriod() const;
+  unsigned long getSampleMicros() const;
+  BH1750Jitter getJitter() const;
+  void resetJitter();
+
+  unsigned long calibrateBus(unsigned long maxClock = 400000, byte repeats = 20);
+  unsigned long getClock() const;
+  unsigned int getWriteMicros() const;
+  unsigned int getReadMicros() const;
+  void setBusCost(unsigned int writeMicros, unsigned int readMicros);
+
+  void setTrace(BH1750TraceEntry *buffer, unsigned int size, bool wrap = true, bool compress = false);
+  void clearTrace();
+  unsigned int getTraceCount() const;
+  byte getTraceState() const;
+  void dumpTrace(Print &out) const;
+
+  void setReportFilter(BH1750ReportMode mode, float threshold, float hysteresis = 0, unsigned long maxSilence = 0);
+  bool hasChanged();
+  float getResolution() const;
+  float getReportedLux() const;
+  BH1750ReportStats getReportStats() const;
+  void resetReportStats();
+
 private:
   TwoWire *_wire;
   byte _address;
@@ -107,7 +174,9 @@ private:
   bool _processed = false;
   unsigned int _mtregTime;
   unsigned long _startMillis;
-  unsigned long _resultMillis;
+  unsigned long _startMicros;
+  unsigned long _sampleMicros;
+  unsigned long _resultMicros;
   unsigned long _timeoutMillis;
   unsigned long _timeout = 10;
   int _offset = 0;
@@ -116,13 +185,42 @@ private:
   unsigned int _value;
   float _qualFak = 0.5;
   float luxCache;
+  byte _rawStep = 1;
+  bool _readError = false;
   BH1750Quality _quality;
   BH1750Timing _timing;
+  unsigned int _period = 0;
+  unsigned long _nextMicros;
+  bool _pending = false;
+  BH1750Jitter _jitter;
+  unsigned long _clock = 0;
+  unsigned int _writeMicros = 0;
+  unsigned int _readMicros = 0;
+  unsigned int _busMillis = 0;
+  BH1750TraceEntry *_trace = NULL;
+  unsigned int _traceSize = 0;
+  unsigned int _traceHead = 0;
+  unsigned int _traceCount = 0;
+  bool _traceWrap = true;
+  bool _traceCompress = false;
+  byte _traceState = 0;
+  BH1750ReportMode _reportMode = BH1750_REPORT_LUX;
+  float _reportThreshold = 0;
+  float _reportHysteresis = 0;
+  unsigned long _maxSilence = 0;
+  unsigned long _reportMillis = 0;
+  float _reportedLux = 0;
+  signed char _reportDirection = 0;
+  bool _reportValid = false;
+  BH1750ReportStats _reportStats = {0, 0, 0, 0};
 
   byte checkMtreg(byte mtreg);
+  bool periodFits(byte mtreg, unsigned int period) const;
   bool writeByte(byte b);
 
   unsigned int readValue();
   unsigned int readChange(byte mtreg, BH1750Quality quality, bool change);
+  void traceRecord(byte address, byte flags, unsigned int data);
+  bool testBus(byte address, unsigned int reference, byte repeats, unsigned long &writeMicros, unsigned long &readMicros);
 };
 #endif